@@ -141,18 +141,8 @@ struct ToolHandler: Sendable {
         var configuration = DumperConfiguration.demangleOptions(.default)
         configuration.printFieldOffset = includeFieldOffsets
 
-        var results: [String] = []
-        for typeWrapper in matched {
-            let dumpable: any Dumpable = switch typeWrapper {
-            case .struct(let s): s
-            case .enum(let e): e
-            case .class(let c): c
-            }
-            let semanticString = try await dumpable.dump(using: configuration, in: machO)
-            results.append(semanticString.string)
-        }
-
-        return results.joined(separator: "\n\n")
+        let semanticStrings = try await matched.dumpInQueryScope(using: configuration, in: machO)
+        return semanticStrings.map(\.string).joined(separator: "\n\n")
     }
 
     // MARK: - Protocol Analysis
@@ -750,6 +750,8 @@ extension Target {
         name: "MachOSymbolsTests",
         dependencies: [
             .target(.MachOSymbols),
+            .target(.MachOSwiftSection),
+            .target(.SwiftInspection),
             .target(.MachOTestingSupport),
             .target(.MachOFixtureSupport),
             .product(.Demangling),
@@ -814,6 +816,7 @@ extension Target {
         name: "SwiftDumpTests",
         dependencies: [
             .target(.SwiftDump),
+            .target(.MachOSymbols),
             .target(.MachOTestingSupport),
             .target(.MachOFixtureSupport),
             .product(.MachOObjCSection),
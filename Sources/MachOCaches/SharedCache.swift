@@ -10,11 +10,11 @@ open class SharedCache<Storage>: @unchecked Sendable {
 
     package init() {
         memoryPressureMonitor.memoryWarningHandler = { [weak self] in
-            self?.storageByIdentifier.removeAll()
+            self?.removeAll()
         }
 
         memoryPressureMonitor.memoryCriticalHandler = { [weak self] in
-            self?.storageByIdentifier.removeAll()
+            self?.removeAll()
         }
 
         memoryPressureMonitor.startMonitoring()
@@ -98,6 +98,16 @@ open class SharedCache<Storage>: @unchecked Sendable {
         return contains(key: machO.identifier)
     }
 
+    /// Returns `true` when a build for `machO`'s identifier is finished
+    /// **or** in flight. A subclass publishing a side cache derived from the
+    /// same image checks this instead of ``contains(in:)``: an in-flight
+    /// build may already have consumed and dropped the side entry, so
+    /// publishing behind it would leave the entry orphaned.
+    package func containsOrIsBuilding<MachO: MachORepresentableWithCache>(in machO: MachO) -> Bool {
+        let key: AnyHashable = machO.identifier
+        return _storageByIdentifier.withLockUnchecked { $0[key] != nil }
+    }
+
     /// Type-keyed variant matching ``storage()``.
     public func contains() -> Bool {
         return contains(key: currentIdentifer)
@@ -118,7 +128,10 @@ open class SharedCache<Storage>: @unchecked Sendable {
     /// completed result simply won't be re-installed because the in-flight
     /// marker has already been removed by the time we check on the build
     /// path. Safe to call even when no entry exists.
-    public func remove<MachO: MachORepresentableWithCache>(for machO: MachO) {
+    ///
+    /// `open` so a subclass holding side caches derived from the same image
+    /// can drop them alongside the main entry.
+    open func remove<MachO: MachORepresentableWithCache>(for machO: MachO) {
         remove(key: machO.identifier)
     }
 
@@ -137,8 +150,10 @@ open class SharedCache<Storage>: @unchecked Sendable {
 
     /// Drops every cached entry. Equivalent to the memory-pressure path but
     /// available to callers that want explicit control (e.g. tests, or a
-    /// long-lived process flushing between unrelated batches).
-    public func removeAll() {
+    /// long-lived process flushing between unrelated batches). The
+    /// memory-pressure handlers route through here too, so a subclass
+    /// override sees every eviction.
+    open func removeAll() {
         _storageByIdentifier.withLockUnchecked { dict in
             dict.removeAll(keepingCapacity: false)
         }
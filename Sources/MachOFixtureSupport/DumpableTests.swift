@@ -26,7 +26,7 @@ package struct DumpableTypeOptions: OptionSet, Sendable {
 }
 
 extension DumperConfiguration {
-    static let test = Self(
+    package static let test = Self(
         demangleResolver: .options(.test),
         displayParentName: true,
         printFieldOffset: true,
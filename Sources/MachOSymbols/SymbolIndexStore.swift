@@ -129,6 +129,101 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
         }
     }
 
+    /// The mangled contexts of the nominal types a query is about, used to
+    /// answer it (dumping a few types, an MCP `dump_type` request) without
+    /// the whole-image demangle sweep.
+    ///
+    /// Inside `withQueryScope(_:in:operation:)`, storage lookups on that
+    /// image — until a full build for it starts — resolve to a *partial*
+    /// storage: the symbol table and offset index are collected in full
+    /// (byte-level, no demangling), but only rows whose entity mangling
+    /// starts with one of the scoped context prefixes are demangled and
+    /// classified. Name- and offset-keyed lookups therefore stay exact —
+    /// unswept names take the late-demangle path — while the classification
+    /// indexes (member, kind, global and opaque-descriptor queries) cover
+    /// the scoped types only.
+    /// Whole-image consumers must not run inside a scope.
+    ///
+    /// The scope is task-local. Name- and offset-keyed lookups that hop to
+    /// another thread (a large-stack demangle resolving a symbolic reference
+    /// back through the index) still resolve against the image's partial
+    /// storage while any scope is active on it.
+    public struct QueryScope: Hashable, Sendable {
+        /// Each context's mangling with the Swift mangling prefix stripped —
+        /// the bytes every symbol of the context starts with after its own
+        /// prefix (`3Mod3FooV` for `Mod.Foo`). Empty for `lookupsOnly`.
+        let contextManglingPrefixes: [[UInt8]]
+
+        init(contextManglingPrefixes: [[UInt8]]) {
+            self.contextManglingPrefixes = contextManglingPrefixes
+        }
+
+        /// A scope that demangles nothing: name and offset lookups resolve
+        /// against the collected table, and classification queries see only
+        /// the types an earlier scope already swept. This is the scope to
+        /// compute a real one in — `MetadataReader.demangleContext` looks
+        /// symbols up by offset for types in anonymous (private) contexts,
+        /// which would otherwise build the full storage before the scoped
+        /// query even starts.
+        public static let lookupsOnly = QueryScope(contextManglingPrefixes: [])
+
+        /// Remangles a nominal type context node (as produced by
+        /// `MetadataReader.demangleContext`). Returns `nil` when the node
+        /// does not remangle, which callers treat as "no scope": the query
+        /// then runs against the full storage as before.
+        public init?(contextNode: Node) {
+            self.init(contextNodes: [contextNode])
+        }
+
+        /// One scope over several types, so they share a single partial
+        /// sweep instead of widening it once per type. `nil` when the list
+        /// is empty or any node fails to remangle — a scope that silently
+        /// dropped a type would answer that type's queries incompletely.
+        public init?(contextNodes: [Node]) {
+            var contextManglingPrefixes: [[UInt8]] = []
+            for contextNode in contextNodes {
+                guard let contextManglingPrefix = Self.contextManglingPrefix(for: contextNode) else { return nil }
+                if !contextManglingPrefixes.contains(contextManglingPrefix) {
+                    contextManglingPrefixes.append(contextManglingPrefix)
+                }
+            }
+            guard !contextManglingPrefixes.isEmpty else { return nil }
+            self.init(contextManglingPrefixes: contextManglingPrefixes)
+        }
+
+        private static func contextManglingPrefix(for contextNode: Node) -> [UInt8]? {
+            var nominalNode = contextNode
+            while nominalNode.kind == .type, let child = nominalNode.children.first {
+                nominalNode = child
+            }
+            guard nominalNode.kind.typeKind != nil, let mangledName = try? mangleAsString(nominalNode) else { return nil }
+            let mangledBytes = Array(mangledName.utf8)
+            let manglingPrefixByteCount = mangledBytes.withUnsafeBufferPointer { swiftManglingPrefixByteCount($0) } ?? 0
+            guard mangledBytes.count > manglingPrefixByteCount else { return nil }
+            return Array(mangledBytes[manglingPrefixByteCount...])
+        }
+    }
+
+    /// Which rows of a partial storage went through the demangler, and for
+    /// which context prefixes. A storage without one is a full sweep.
+    struct PartialSweep: Sendable {
+        let contextManglingPrefixes: [[UInt8]]
+
+        /// Parallel to the symbol table: `true` for rows the sweep demangled
+        /// (their `rootNodeIndexByTableRow` entry is a real verdict), `false`
+        /// for rows it never looked at.
+        let sweptRowMask: [Bool]
+
+        /// A swept prefix covers every longer prefix it starts: the longer
+        /// one's candidates are a subset of the shorter one's. `lookupsOnly`
+        /// has no prefixes and is covered by any partial storage.
+        func covers(_ queryScope: QueryScope) -> Bool {
+            queryScope.contextManglingPrefixes.allSatisfy { queriedPrefix in
+                contextManglingPrefixes.contains { queriedPrefix.starts(with: $0) }
+            }
+        }
+    }
+
     public final class Storage: @unchecked Sendable {
         typealias MemberSymbolRows = OrderedDictionary<String, OrderedDictionary<NodeStore.NodeIndex, SymbolRowBucket>>
 
@@ -200,6 +295,10 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
 
         let thunkAttributeMembersByKindAndTypeName: [Node.Kind: [String: [ThunkAttributeMember]]]
 
+        /// `nil` for a full sweep; set for a query-scoped partial storage
+        /// (see `QueryScope`).
+        let partialSweep: PartialSweep?
+
         /// Symbols demangled after the store was frozen (rare path: lookups
         /// for names that were not part of the build sweep). The frozen main
         /// arena cannot grow, so late names go into this appendable per-image
@@ -226,7 +325,8 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
             symbolTable: SymbolTable,
             rootNodeIndexByTableRow: [NodeStore.NodeIndex?],
             symbolRowsByOffset: [Int: SymbolRowBucket],
-            rowIndexes: consuming RowIndexes
+            rowIndexes: consuming RowIndexes,
+            partialSweep: PartialSweep?
         ) {
             self.nodeStore = nodeStore
             self.symbolTable = symbolTable
@@ -253,6 +353,14 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
             self.protocolWitnessMemberSymbolRowsByKind = rowIndexes.protocolWitnessMemberSymbolRowsByKind
             self.symbolRowsByKind = rowIndexes.symbolRowsByKind
             self.thunkAttributeMembersByKindAndTypeName = rowIndexes.thunkAttributeMembersByKindAndTypeName
+            self.partialSweep = partialSweep
+        }
+
+        /// Whether the row's `rootNodeIndexByTableRow` entry is a demangler
+        /// verdict. Always true for a full sweep; a partial sweep leaves
+        /// rows outside its context prefixes untouched.
+        func wasSwept(row: UInt32) -> Bool {
+            partialSweep?.sweptRowMask[Int(row)] ?? true
         }
 
         /// Get-or-demangle for a name outside the build sweep.
@@ -393,6 +501,52 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
 
     public static let shared = SymbolIndexStore()
 
+    /// The scope `storage(in:)` resolves against, if any. Task-local so a
+    /// scoped dump and an unscoped whole-image build running concurrently
+    /// on the same image never see each other's scope.
+    @TaskLocal
+    private static var currentQueryScope: ActiveQueryScope?
+
+    /// One `withQueryScope` call: the scope, the image it applies to, and
+    /// the storage its first lookup resolved to. Every later lookup in the
+    /// scope returns that storage directly — no coverage check, no cache
+    /// lookup — which matters because a single dump makes many of them.
+    private final class ActiveQueryScope: @unchecked Sendable {
+        let queryScope: QueryScope
+        let identifier: AnyHashable
+
+        @Mutex
+        var resolvedStorage: Storage?
+
+        init(queryScope: QueryScope, identifier: AnyHashable) {
+            self.queryScope = queryScope
+            self.identifier = identifier
+        }
+    }
+
+    /// Running `withQueryScope` calls per image identifier. The task-local
+    /// above does not survive the demangler's hop to a large-stack worker
+    /// thread (see `buildStorageImpl`), and that is exactly where a private
+    /// or anonymous context's symbolic reference is resolved. Name- and
+    /// offset-keyed lookups arriving without a task-local scope consult
+    /// this instead (`lookupStorage(in:)`); classification queries never
+    /// do, so an unrelated unscoped consumer of the same image still gets
+    /// whole-image answers.
+    @Mutex
+    private var activeQueryScopeCountByIdentifier: [AnyHashable: Int] = [:]
+
+    /// Query-scoped partial storages, one per image identifier. A later
+    /// scope that the entry does not cover replaces it with a wider partial
+    /// seeded from it; a full build adopts it and drops it. Evicted together
+    /// with the full storages (`remove(for:)` / `removeAll()`).
+    ///
+    /// An entry can also be collection-only (no prefixes, nothing swept):
+    /// that is what a `lookupsOnly` scope or a scope that fell back leaves
+    /// behind, so the full build that follows adopts the collected table
+    /// instead of collecting it a second time.
+    @Mutex
+    private var partialStorageByIdentifier: [AnyHashable: Storage] = [:]
+
     private override init() {
         super.init()
     }
@@ -401,6 +555,102 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
         return buildStorageImpl(for: machO, progressContinuation: nil)
     }
 
+    /// Partial sweeps past either bound fall back to the full build (which
+    /// adopts the partial storage, so nothing is demangled twice). Past
+    /// them a partial sweep stops being cheaper than the full one: every
+    /// widening re-scans the table and re-interns the rows already swept,
+    /// and the partial entry would otherwise grow without ever being
+    /// promoted.
+    static let maximumPartialSweepContextCount = 64
+    static let maximumPartialSweptRowFraction = 0.25
+
+    /// Routes to the query-scoped partial storage while a `QueryScope` is
+    /// active on `machO` and no full storage exists yet. A full storage that
+    /// is finished *or being built* always wins: it answers every scope, and
+    /// joining a running build is cheaper than sweeping beside it (whose
+    /// result could not be published anyway). A scope that a partial sweep
+    /// cannot serve — a prefix matching no row (a remangle that differs
+    /// from the compiler's bytes, or a type with no symbols), or a sweep
+    /// past the size bounds above — falls back to the full build, so a
+    /// scope can cost latency but never change an answer for the scoped
+    /// types. Either way the answer is kept for the rest of the scope.
+    public override func storage<MachO: MachORepresentableWithCache>(in machO: MachO) -> Storage? {
+        guard let activeQueryScope = Self.currentQueryScope, activeQueryScope.identifier == AnyHashable(machO.identifier) else {
+            return super.storage(in: machO)
+        }
+        if let resolvedStorage = activeQueryScope.resolvedStorage {
+            return resolvedStorage
+        }
+        let partialStorage = containsOrIsBuilding(in: machO) ? nil : partialStorage(covering: activeQueryScope.queryScope, in: machO)
+        let resolvedStorage = partialStorage ?? super.storage(in: machO)
+        activeQueryScope.resolvedStorage = resolvedStorage
+        return resolvedStorage
+    }
+
+    /// The storage for name- and offset-keyed lookups, which any partial
+    /// storage answers exactly. A lookup made off the scoped task while a
+    /// scope is active on `machO` — the demangler's large-stack worker
+    /// calling back in — resolves to the image's partial entry (collecting
+    /// one if there is none yet) instead of starting the full build the
+    /// scope exists to avoid.
+    private func lookupStorage<MachO: MachORepresentableWithCache>(in machO: MachO) -> Storage? {
+        let key: AnyHashable = machO.identifier
+        if Self.currentQueryScope?.identifier != key,
+           _activeQueryScopeCountByIdentifier.withLockUnchecked({ $0[key] != nil }),
+           !containsOrIsBuilding(in: machO),
+           let partialStorage = partialStorage(covering: .lookupsOnly, in: machO) {
+            return partialStorage
+        }
+        return storage(in: machO)
+    }
+
+    public override func remove<MachO: MachORepresentableWithCache>(for machO: MachO) {
+        super.remove(for: machO)
+        _partialStorageByIdentifier.withLockUnchecked { _ = $0.removeValue(forKey: machO.identifier) }
+    }
+
+    public override func removeAll() {
+        super.removeAll()
+        _partialStorageByIdentifier.withLockUnchecked { $0.removeAll(keepingCapacity: false) }
+    }
+
+    /// Runs `operation` with `queryScope` active for every `SymbolIndexStore`
+    /// lookup it makes on `machO`. A `nil` scope runs it unscoped.
+    public static func withQueryScope<MachO: MachORepresentableWithCache, Result>(_ queryScope: QueryScope?, in machO: MachO, operation: () throws -> Result) rethrows -> Result {
+        guard let queryScope else { return try operation() }
+        let activeQueryScope = ActiveQueryScope(queryScope: queryScope, identifier: machO.identifier)
+        shared.beginQueryScope(activeQueryScope)
+        defer { shared.endQueryScope(activeQueryScope) }
+        return try $currentQueryScope.withValue(activeQueryScope, operation: operation)
+    }
+
+    public static func withQueryScope<MachO: MachORepresentableWithCache, Result>(
+        _ queryScope: QueryScope?,
+        in machO: MachO,
+        isolation: isolated (any Actor)? = #isolation,
+        operation: () async throws -> Result
+    ) async rethrows -> Result {
+        guard let queryScope else { return try await operation() }
+        let activeQueryScope = ActiveQueryScope(queryScope: queryScope, identifier: machO.identifier)
+        shared.beginQueryScope(activeQueryScope)
+        defer { shared.endQueryScope(activeQueryScope) }
+        return try await $currentQueryScope.withValue(activeQueryScope, operation: operation)
+    }
+
+    private func beginQueryScope(_ activeQueryScope: ActiveQueryScope) {
+        _activeQueryScopeCountByIdentifier.withLockUnchecked { $0[activeQueryScope.identifier, default: 0] += 1 }
+    }
+
+    private func endQueryScope(_ activeQueryScope: ActiveQueryScope) {
+        _activeQueryScopeCountByIdentifier.withLockUnchecked { activeQueryScopeCountByIdentifier in
+            if let activeQueryScopeCount = activeQueryScopeCountByIdentifier[activeQueryScope.identifier], activeQueryScopeCount > 1 {
+                activeQueryScopeCountByIdentifier[activeQueryScope.identifier] = activeQueryScopeCount - 1
+            } else {
+                _ = activeQueryScopeCountByIdentifier.removeValue(forKey: activeQueryScope.identifier)
+            }
+        }
+    }
+
     /// Batch boundary for the sweep's per-symbol demangling.
     ///
     /// `demangleAsNodeTransient` — like every `Demangling` entry point —
@@ -434,6 +684,122 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
         for machO: MachO,
         progressContinuation: AsyncStream<Progress>.Continuation?
     ) -> Storage? {
+        // Merge point for the query-scoped mode: a partial storage already
+        // collected this image's table and demangled its scoped rows, so the
+        // full sweep adopts both instead of paying for them again. Rows
+        // share numbering because the table itself is adopted.
+        let partialStorage = _partialStorageByIdentifier.withLockUnchecked { $0[machO.identifier] }
+        let collectedRows = partialStorage.map(CollectedSymbolRows.init(adopting:)) ?? collectSymbolRows(for: machO)
+        let storage = sweepSymbolRows(collectedRows, partialSweep: nil, seed: partialStorage, progressContinuation: progressContinuation)
+        _partialStorageByIdentifier.withLockUnchecked { _ = $0.removeValue(forKey: machO.identifier) }
+        return storage
+    }
+
+    /// The partial storage covering `queryScope`, or `nil` to fall back to
+    /// the full build: the cached entry when its prefixes already cover the
+    /// scope, otherwise a wider one built from it.
+    ///
+    /// Whatever the build produced is published — a fallback publishes the
+    /// collection-only (or unchanged seed) storage so the full build adopts
+    /// its table — but only over the entry it extended (a concurrent
+    /// extension that landed first is kept; this call still answers from
+    /// its own, equally correct build), and never once a full build is
+    /// finished or in flight: that build has already taken or dropped the
+    /// entry, and nothing would ever remove one published behind it.
+    private func partialStorage<MachO: MachORepresentableWithCache>(covering queryScope: QueryScope, in machO: MachO) -> Storage? {
+        let key: AnyHashable = machO.identifier
+        let seed = _partialStorageByIdentifier.withLockUnchecked { $0[key] }
+        if let seed, seed.partialSweep?.covers(queryScope) == true {
+            return seed
+        }
+        // Same batch boundary as `buildStorageImpl`: one large-stack hop
+        // for the whole candidate sweep.
+        let partialBuild = StackSafeExecutor.withLargeStack {
+            self.buildPartialStorage(for: machO, adding: queryScope, seed: seed)
+        }
+        if partialBuild.storage !== seed {
+            _partialStorageByIdentifier.withLockUnchecked { partialStorageByIdentifier in
+                guard partialStorageByIdentifier[key] === seed, !containsOrIsBuilding(in: machO) else { return }
+                partialStorageByIdentifier[key] = partialBuild.storage
+            }
+        }
+        return partialBuild.coversQueryScope ? partialBuild.storage : nil
+    }
+
+    /// Builds a partial storage sweeping `seed`'s prefixes plus
+    /// `queryScope`'s. The candidate test is byte-level on the table's name
+    /// bytes (`SymbolTable.withEntityManglingBytes`), so only the
+    /// candidates are ever demangled; rows `seed` already swept reuse its
+    /// trees.
+    ///
+    /// `coversQueryScope` is `false` when the scope has to fall back: some
+    /// new prefix selects no row, or the sweep would pass the size bounds.
+    /// The storage returned then is `seed` itself, or — with no seed — a
+    /// collection-only storage, so the collection work is kept for the full
+    /// build rather than thrown away.
+    func buildPartialStorage<MachO: MachORepresentableWithCache>(for machO: MachO, adding queryScope: QueryScope, seed: Storage?) -> (storage: Storage, coversQueryScope: Bool) {
+        let collectedRows = seed.map(CollectedSymbolRows.init(adopting:)) ?? collectSymbolRows(for: machO)
+        let symbolTable = collectedRows.symbolTable
+        let sweptContextManglingPrefixes = seed?.partialSweep?.contextManglingPrefixes ?? []
+        let addedContextManglingPrefixes = queryScope.contextManglingPrefixes.filter { !sweptContextManglingPrefixes.contains($0) }
+
+        func fallBack() -> (storage: Storage, coversQueryScope: Bool) {
+            let collectionOnlySweep = PartialSweep(contextManglingPrefixes: [], sweptRowMask: [Bool](repeating: false, count: symbolTable.rowCount))
+            return (seed ?? sweepSymbolRows(collectedRows, partialSweep: collectionOnlySweep, seed: nil, progressContinuation: nil), false)
+        }
+
+        guard sweptContextManglingPrefixes.count + addedContextManglingPrefixes.count <= Self.maximumPartialSweepContextCount else {
+            return fallBack()
+        }
+
+        // One pass over the table, one name-bytes access per row: the Swift
+        // prefix is stripped once and every added prefix is tested against
+        // the same entity bytes.
+        var sweptRowMask = seed?.partialSweep?.sweptRowMask ?? [Bool](repeating: false, count: symbolTable.rowCount)
+        var matchedRowCountByAddedPrefix = [Int](repeating: 0, count: addedContextManglingPrefixes.count)
+        if !addedContextManglingPrefixes.isEmpty {
+            for row in 0 ..< symbolTable.rowCount {
+                _ = symbolTable.withEntityManglingBytes(atRow: UInt32(row)) { entityBytes in
+                    for (prefixIndex, contextManglingPrefix) in addedContextManglingPrefixes.enumerated() where entityBytes.starts(with: contextManglingPrefix) {
+                        matchedRowCountByAddedPrefix[prefixIndex] += 1
+                        sweptRowMask[row] = true
+                    }
+                }
+            }
+        }
+        let sweptRowCount = sweptRowMask.lazy.filter { $0 }.count
+        guard !matchedRowCountByAddedPrefix.contains(0),
+              Double(sweptRowCount) <= Double(symbolTable.rowCount) * Self.maximumPartialSweptRowFraction else {
+            return fallBack()
+        }
+        let partialSweep = PartialSweep(
+            contextManglingPrefixes: sweptContextManglingPrefixes + addedContextManglingPrefixes,
+            sweptRowMask: sweptRowMask
+        )
+        return (sweepSymbolRows(collectedRows, partialSweep: partialSweep, seed: seed, progressContinuation: nil), true)
+    }
+
+    /// Output of the collection phase: the frozen symbol table and the
+    /// offset index over it. Everything here is byte-level work; the
+    /// demangler has not run yet.
+    fileprivate struct CollectedSymbolRows {
+        let symbolTable: SymbolTable
+        let symbolRowsByOffset: [Int: SymbolRowBucket]
+
+        init(symbolTable: SymbolTable, symbolRowsByOffset: [Int: SymbolRowBucket]) {
+            self.symbolTable = symbolTable
+            self.symbolRowsByOffset = symbolRowsByOffset
+        }
+
+        /// Reuses a storage's collection phase. A storage's table and offset
+        /// index are always complete — a partial sweep restricts only which
+        /// rows get demangled — so adopting them is exact.
+        init(adopting storage: Storage) {
+            self.init(symbolTable: storage.symbolTable, symbolRowsByOffset: storage.symbolRowsByOffset)
+        }
+    }
+
+    private func collectSymbolRows<MachO: MachORepresentableWithCache>(for machO: MachO) -> CollectedSymbolRows {
         // Reader split (proposal 0001): a MachOImage's symbol names already
         // live in the image's mmap'd string table, so its rows reference
         // those bytes in place — zero copies, zero retained strings — and
@@ -555,7 +921,20 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
         // demangler's entry point takes a `String` until the upstream
         // byte-span entry lands, see proposal 0001's upstream-interface
         // section).
-        let symbolTable = tableBuilder.freeze()
+        return CollectedSymbolRows(symbolTable: tableBuilder.freeze(), symbolRowsByOffset: symbolRowsByOffset)
+    }
+
+    /// The demangle phase. `partialSweep` restricts it to the masked rows;
+    /// rows `seed` already swept (a partial storage over the same table)
+    /// rebuild their transient tree from `seed`'s arena instead of
+    /// re-running the demangler, and keep its rejections as rejections.
+    private func sweepSymbolRows(
+        _ collectedRows: CollectedSymbolRows,
+        partialSweep: PartialSweep?,
+        seed: Storage?,
+        progressContinuation: AsyncStream<Progress>.Continuation?
+    ) -> Storage {
+        let symbolTable = collectedRows.symbolTable
 
         // Single sequential sweep: demangle each symbol cache-free onto a
         // transient tree, classify on that tree, and intern the result into
@@ -567,7 +946,7 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
         let totalSymbolCount = symbolTable.rowCount
 
         var builder = NodeStoreBuilder()
-        builder.reserveCapacity(expectedSymbolCount: totalSymbolCount)
+        builder.reserveCapacity(expectedSymbolCount: partialSweep.map { $0.sweptRowMask.lazy.filter { $0 }.count } ?? totalSymbolCount)
         var rootNodeIndexByTableRow = [NodeStore.NodeIndex?](repeating: nil, count: totalSymbolCount)
         var rowIndexes = RowIndexes()
 
@@ -576,8 +955,19 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
                 progressContinuation?.yield(Progress(currentCount: row, totalCount: totalSymbolCount))
             }
 
+            if let partialSweep, !partialSweep.sweptRowMask[row] {
+                continue
+            }
+
             let symbolTableRow = UInt32(row)
-            guard let rootNode = try? demangleAsNodeTransient(symbolTable.materializedName(atRow: symbolTableRow)) else { continue }
+            let rootNode: Node
+            if let seed, seed.wasSwept(row: symbolTableRow) {
+                guard let seededRootNodeIndex = seed.rootNodeIndexByTableRow[row] else { continue }
+                rootNode = seed.nodeStore.reference(at: seededRootNodeIndex).materialize()
+            } else {
+                guard let demangledRootNode = try? demangleAsNodeTransient(symbolTable.materializedName(atRow: symbolTableRow)) else { continue }
+                rootNode = demangledRootNode
+            }
             rootNodeIndexByTableRow[row] = builder.intern(rootNode)
 
             guard rootNode.isKind(of: .global), let node = rootNode.children.first else { continue }
@@ -627,8 +1017,9 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
             nodeStore: builder.freeze(),
             symbolTable: symbolTable,
             rootNodeIndexByTableRow: rootNodeIndexByTableRow,
-            symbolRowsByOffset: symbolRowsByOffset,
-            rowIndexes: rowIndexes
+            symbolRowsByOffset: collectedRows.symbolRowsByOffset,
+            rowIndexes: rowIndexes,
+            partialSweep: partialSweep
         )
     }
 
@@ -976,7 +1367,7 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
     }
 
     package func symbols<MachO: MachORepresentableWithCache>(for offset: Int, in machO: MachO) -> Symbols? {
-        guard let storage = storage(in: machO), let rows = storage.symbolRowsByOffset[offset], !rows.isEmpty else { return nil }
+        guard let storage = lookupStorage(in: machO), let rows = storage.symbolRowsByOffset[offset], !rows.isEmpty else { return nil }
         return .init(offset: offset, symbols: rows.map { storage.symbol(atRow: $0, offset: offset) })
     }
 
@@ -985,7 +1376,7 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
     /// the sweep are demangled cache-free into a per-symbol mini store, so
     /// every caller receives a uniform `NodeReference`.
     package func demangledNodeReference<MachO: MachORepresentableWithCache>(for symbol: Symbol, in machO: MachO) -> NodeReference? {
-        guard let cacheStorage = storage(in: machO) else { return nil }
+        guard let cacheStorage = lookupStorage(in: machO) else { return nil }
         // Matched on name alone. A demangled tree is a pure function of the
         // symbol name and the flat table already holds one row per unique
         // name, so the row's own offset carries no extra information here —
@@ -1002,7 +1393,11 @@ public final class SymbolIndexStore: SharedCache<SymbolIndexStore.Storage>, @unc
         // is a byte-level binary search over the table's name-order
         // permutation (proposal 0001) — the name-keyed dictionary it
         // replaces retained every symbol name for the storage's lifetime.
-        if let row = cacheStorage.symbolTable.row(forName: symbol.name) {
+        //
+        // A query-scoped partial storage holds every row but demangled only
+        // its candidates; an unswept row has no verdict yet, so it takes the
+        // late path exactly like a name outside the table.
+        if let row = cacheStorage.symbolTable.row(forName: symbol.name), cacheStorage.wasSwept(row: row) {
             // The sweep already ran every table row through the demangler
             // once; a `nil` root records that it rejected this name. The
             // late path runs the *same* demangler (`NodeStoreBuilder.demangle`
@@ -380,3 +380,45 @@ func nameBytesHaveSwiftManglingPrefix(_ nameC: UnsafePointer<CChar>) -> Bool {
         return false
     }
 }
+
+/// Byte length of the Swift mangling prefix `nameBytes` starts with, or `nil`
+/// when it carries none — the same prefix set as
+/// `nameBytesHaveSwiftManglingPrefix`, over a bounded buffer instead of a
+/// C string (frozen table rows have no terminator). Used by the query-scoped
+/// sweep to find where a name's entity mangling begins.
+func swiftManglingPrefixByteCount(_ nameBytes: UnsafeBufferPointer<UInt8>) -> Int? {
+    func hasPrefix(_ prefix: StaticString) -> Bool {
+        let prefixByteCount = prefix.utf8CodeUnitCount
+        guard nameBytes.count >= prefixByteCount else { return false }
+        return memcmp(nameBytes.baseAddress.unsafelyUnwrapped, prefix.utf8Start, prefixByteCount) == 0
+    }
+    guard let firstByte = nameBytes.first else { return nil }
+    switch firstByte {
+    case 0x5F: // "_"
+        return hasPrefix("_T0") || hasPrefix("_$S") || hasPrefix("_$s") || hasPrefix("_$e") ? 3 : nil
+    case 0x24: // "$"
+        return hasPrefix("$S") || hasPrefix("$s") || hasPrefix("$e") ? 2 : nil
+    case 0x40: // "@"
+        return hasPrefix("@__swiftmacro_") ? 14 : nil
+    default:
+        return nil
+    }
+}
+
+extension SymbolTable {
+    /// Runs `body` over the row's name past its Swift mangling prefix — the
+    /// entity mangling the query-scoped sweep pre-filters on — or returns
+    /// `nil` for a name without one. Swift manglings are post-order with
+    /// the entity's context first, so every member, accessor, descriptor
+    /// and thunk of a nominal type — extension members included, whose
+    /// mangling leads with the extended type — begins with that type's
+    /// context mangling. Word substitutions only ever refer backwards, so
+    /// the leading context bytes are identical across every symbol that
+    /// starts with them.
+    func withEntityManglingBytes<Result>(atRow row: UInt32, _ body: (UnsafeBufferPointer<UInt8>) throws -> Result) rethrows -> Result? {
+        try withNameBytes(atRow: row) { nameBytes in
+            guard let manglingPrefixByteCount = swiftManglingPrefixByteCount(nameBytes) else { return nil }
+            return try body(UnsafeBufferPointer(rebasing: nameBytes[manglingPrefixByteCount...]))
+        }
+    }
+}
@@ -0,0 +1,49 @@
+import Foundation
+import MachOSwiftSection
+import Semantic
+import Demangling
+@_spi(Internals) import MachOSymbols
+@_spi(Internals) import SwiftInspection
+import SwiftDeclarationRendering
+
+extension TypeContextWrapper {
+    /// Dumps this one type against a symbol index scoped to it. See the
+    /// `Array<TypeContextWrapper>` overload, which this forwards to.
+    public func dumpInQueryScope<MachO: FieldLayoutRenderable>(using configuration: DumperConfiguration, in machO: MachO) async throws -> SemanticString {
+        try await [self].dumpInQueryScope(using: configuration, in: machO)[0]
+    }
+}
+
+extension Array where Element == TypeContextWrapper {
+    /// Dumps these types against one symbol index scoped to all of them, for
+    /// callers that render a handful of types out of an image (an MCP
+    /// `dump_type` request): only the symbols whose mangling starts with one
+    /// of the types' contexts are demangled, so latency and memory follow
+    /// the types rather than the image. Output is identical to
+    /// `dump(using:in:)` on each wrapped type.
+    ///
+    /// The contexts are themselves demangled under a lookups-only scope, so
+    /// resolving an anonymous or private context's symbolic references hits
+    /// the collected offset index instead of building the full sweep. When
+    /// any context cannot be remangled, or the types together are too many
+    /// or too large for a partial sweep, everything dumps against the full
+    /// index (which adopts the rows collected here).
+    public func dumpInQueryScope<MachO: FieldLayoutRenderable>(using configuration: DumperConfiguration, in machO: MachO) async throws -> [SemanticString] {
+        let queryScope = SymbolIndexStore.withQueryScope(.lookupsOnly, in: machO) { () -> SymbolIndexStore.QueryScope? in
+            var contextNodes: [Node] = []
+            for typeContextWrapper in self {
+                guard let contextNode = try? MetadataReader.demangleContext(for: typeContextWrapper.contextDescriptorWrapper, in: machO) else { return nil }
+                contextNodes.append(contextNode)
+            }
+            return SymbolIndexStore.QueryScope(contextNodes: contextNodes)
+        }
+        return try await SymbolIndexStore.withQueryScope(queryScope, in: machO) {
+            var dumps: [SemanticString] = []
+            dumps.reserveCapacity(count)
+            for typeContextWrapper in self {
+                try await dumps.append(typeContextWrapper.dumpable.dump(using: configuration, in: machO))
+            }
+            return dumps
+        }
+    }
+}
@@ -3,6 +3,16 @@ import MachOSwiftSection
 import SwiftDeclarationRendering
 
 extension TypeContextWrapper {
+    /// The wrapped type as a `Dumpable`, for callers that dump without
+    /// caring which kind of type it is.
+    package var dumpable: any Dumpable {
+        switch self {
+        case .enum(let type): type
+        case .struct(let type): type
+        case .class(let type): type
+        }
+    }
+
     package func dumper(using configuration: DumperConfiguration, metadata: MetadataWrapper? = nil, in machO: some FieldLayoutRenderable) -> any TypedDumper {
         switch self {
         case .enum(let type):
@@ -0,0 +1,247 @@
+import Foundation
+import Testing
+@_spi(Internals) import Demangling
+@_spi(Internals) @testable import MachOSymbols
+@_spi(Internals) import MachOCaches
+@_spi(Internals) import SwiftInspection
+import MachOSwiftSection
+@testable import MachOTestingSupport
+import MachOFixtureSupport
+
+/// Query-scoped partial sweeps (`SymbolIndexStore.QueryScope`) against the
+/// `SymbolTestsCore` fixture. Scopes are computed the way `dumpInQueryScope`
+/// computes them — `MetadataReader.demangleContext` under a lookups-only
+/// scope — so a remangle that drifts from the compiler's bytes, or a scope
+/// computation that builds the full storage behind the scope's back, fails
+/// here. Every partial storage is checked against the full sweep by the one
+/// comparison in `expectMembersClassifiedLikeFullSweep`.
+///
+/// Serialized: every test evicts and rebuilds the shared per-file storage.
+@Suite(.serialized)
+final class SymbolIndexStoreQueryScopeTests: MachOFileTests, @unchecked Sendable {
+    override class var fileName: MachOFileName { .SymbolTestsCore }
+
+    private typealias Storage = SymbolIndexStore.Storage
+    private typealias QueryScope = SymbolIndexStore.QueryScope
+
+    private var types: [TypeContextWrapper] {
+        get throws {
+            try machOFile.swift.types
+        }
+    }
+
+    private func name(of type: TypeContextWrapper) -> String {
+        (try? type.typeContextDescriptorWrapper.namedContextDescriptor.name(in: machOFile)) ?? "<unnamed>"
+    }
+
+    private func scope(for type: TypeContextWrapper) throws -> QueryScope? {
+        let contextNode = try SymbolIndexStore.withQueryScope(.lookupsOnly, in: machOFile) {
+            try MetadataReader.demangleContext(for: type.contextDescriptorWrapper, in: machOFile)
+        }
+        return QueryScope(contextNode: contextNode)
+    }
+
+    private func resolveStorage(scopedTo queryScope: QueryScope) -> Storage? {
+        SymbolIndexStore.withQueryScope(queryScope, in: machOFile) {
+            SymbolIndexStore.shared.storage(in: machOFile)
+        }
+    }
+
+    /// A partial storage classifies members exactly like the full sweep, in
+    /// both directions: every member bucket it holds is in the full sweep,
+    /// and every full-sweep bucket whose rows it swept is in it — under the
+    /// same type name and a structurally equal type node, with the same
+    /// rows in the same order. Row numbers compare directly because the
+    /// collection phase is deterministic.
+    private func expectMembersClassifiedLikeFullSweep(_ partialStorage: Storage, _ fullStorage: Storage, _ label: String, sourceLocation: SourceLocation = #_sourceLocation) {
+        #expect(partialStorage.symbolTable.rowCount == fullStorage.symbolTable.rowCount, "\(label)", sourceLocation: sourceLocation)
+        #expect(partialStorage.symbolRowsByOffset.count == fullStorage.symbolRowsByOffset.count, "\(label)", sourceLocation: sourceLocation)
+        for memberRowsByKind in [\Storage.memberSymbolRowsByKind, \Storage.methodDescriptorMemberSymbolRowsByKind, \Storage.protocolWitnessMemberSymbolRowsByKind] {
+            func rows(in storage: Storage, _ memberKind: SymbolIndexStore.MemberKind, _ memberTypeName: String, typeNode: Node) -> [UInt32]? {
+                storage[keyPath: memberRowsByKind][memberKind]?[memberTypeName]?
+                    .first { storage.nodeStore.reference(at: $0.key).structurallyEquals(typeNode) }
+                    .map { Array($0.value) }
+            }
+            for (memberKind, memberRows) in partialStorage[keyPath: memberRowsByKind] {
+                for (memberTypeName, rowsByTypeNodeIndex) in memberRows {
+                    for (typeNodeIndex, partialRows) in rowsByTypeNodeIndex {
+                        let typeNode = partialStorage.nodeStore.reference(at: typeNodeIndex).materialize()
+                        #expect(rows(in: fullStorage, memberKind, memberTypeName, typeNode: typeNode) == Array(partialRows), "\(label): \(memberKind) / \(memberTypeName)", sourceLocation: sourceLocation)
+                    }
+                }
+            }
+            for (memberKind, memberRows) in fullStorage[keyPath: memberRowsByKind] {
+                for (memberTypeName, rowsByTypeNodeIndex) in memberRows {
+                    for (typeNodeIndex, fullRows) in rowsByTypeNodeIndex where fullRows.allSatisfy({ partialStorage.wasSwept(row: $0) }) {
+                        let typeNode = fullStorage.nodeStore.reference(at: typeNodeIndex).materialize()
+                        #expect(rows(in: partialStorage, memberKind, memberTypeName, typeNode: typeNode) == Array(fullRows), "\(label): \(memberKind) / \(memberTypeName) missing from the partial sweep", sourceLocation: sourceLocation)
+                    }
+                }
+            }
+        }
+    }
+
+    // MARK: - Scope per fixture type
+
+    /// For every type of the fixture: the scope is computable without
+    /// building the full storage, it resolves to a partial storage that
+    /// sweeps at least one row, and that storage classifies members like
+    /// the full sweep.
+    @Test func everyTypeScopesToMatchingPartialSweep() throws {
+        let fullStorage = try #require(SymbolIndexStore.shared.buildStorage(for: machOFile))
+        for type in try types {
+            let typeName = name(of: type)
+            SymbolIndexStore.shared.remove(for: machOFile)
+
+            let queryScope = try #require(try scope(for: type), "\(typeName)")
+            #expect(!SymbolIndexStore.shared.contains(in: machOFile), "\(typeName): scope computation built the full storage")
+
+            let partialStorage = try #require(resolveStorage(scopedTo: queryScope))
+            let partialSweep = try #require(partialStorage.partialSweep, "\(typeName): scope fell back to the full build")
+            #expect(partialSweep.covers(queryScope), "\(typeName)")
+            #expect(partialSweep.sweptRowMask.contains(true), "\(typeName)")
+            #expect(partialSweep.sweptRowMask.contains(false), "\(typeName)")
+            expectMembersClassifiedLikeFullSweep(partialStorage, fullStorage, typeName)
+        }
+        SymbolIndexStore.shared.remove(for: machOFile)
+    }
+
+    // MARK: - Widening, promotion and fallback
+
+    /// A second type's scope widens the first type's partial storage (the
+    /// seed path) instead of replacing it; the widened storage still covers
+    /// the first scope and classifies both types like the full sweep. The
+    /// second type is the first one not nested in the first type, whose
+    /// scope the first sweep would already cover.
+    @Test func secondTypeWidensPartialSweep() throws {
+        let fullStorage = try #require(SymbolIndexStore.shared.buildStorage(for: machOFile))
+        let types = try types
+        let firstType = try #require(types.first)
+        let firstQueryScope = try #require(try scope(for: firstType))
+        var secondTypeAndScope: (type: TypeContextWrapper, queryScope: QueryScope)?
+        for type in types.dropFirst() {
+            guard let queryScope = try scope(for: type) else { continue }
+            if !queryScope.contextManglingPrefixes[0].starts(with: firstQueryScope.contextManglingPrefixes[0]) {
+                secondTypeAndScope = (type, queryScope)
+                break
+            }
+        }
+        let (secondType, secondQueryScope) = try #require(secondTypeAndScope)
+        SymbolIndexStore.shared.remove(for: machOFile)
+
+        let firstStorage = try #require(resolveStorage(scopedTo: firstQueryScope))
+        let firstSweep = try #require(firstStorage.partialSweep)
+        let widenedStorage = try #require(resolveStorage(scopedTo: secondQueryScope))
+        let widenedSweep = try #require(widenedStorage.partialSweep)
+
+        #expect(widenedStorage !== firstStorage)
+        #expect(widenedStorage.symbolTable === firstStorage.symbolTable)
+        #expect(widenedSweep.covers(firstQueryScope))
+        #expect(widenedSweep.covers(secondQueryScope))
+        for row in firstSweep.sweptRowMask.indices where firstSweep.sweptRowMask[row] {
+            #expect(widenedSweep.sweptRowMask[row])
+        }
+        #expect(resolveStorage(scopedTo: firstQueryScope) === widenedStorage)
+        expectMembersClassifiedLikeFullSweep(widenedStorage, fullStorage, "\(name(of: firstType)) + \(name(of: secondType))")
+        #expect(!SymbolIndexStore.shared.contains(in: machOFile))
+        SymbolIndexStore.shared.remove(for: machOFile)
+    }
+
+    /// The next unscoped build adopts the partial storage and must come out
+    /// identical to an unseeded full sweep, after which the partial entry
+    /// is gone.
+    @Test func fullSweepSeededFromPartialMatchesUnseededFullSweep() throws {
+        let queryScope = try #require(try scope(for: #require(types.first)))
+        SymbolIndexStore.shared.remove(for: machOFile)
+
+        let scopedStorage = try #require(resolveStorage(scopedTo: queryScope))
+        #expect(scopedStorage.partialSweep != nil)
+        #expect(!SymbolIndexStore.shared.contains(in: machOFile))
+
+        let seededStorage = try #require(SymbolIndexStore.shared.storage(in: machOFile))
+        #expect(seededStorage.partialSweep == nil)
+        #expect(seededStorage.symbolTable === scopedStorage.symbolTable)
+
+        // The partial entry was dropped by the seeded build, so this one
+        // collects and demangles from scratch.
+        let unseededStorage = try #require(SymbolIndexStore.shared.buildStorage(for: machOFile))
+        #expect(unseededStorage.symbolTable !== seededStorage.symbolTable)
+        #expect(seededStorage.rootNodeIndexByTableRow.map { $0 != nil } == unseededStorage.rootNodeIndexByTableRow.map { $0 != nil })
+        #expect(seededStorage.symbolRowsByKind.mapValues(\.count) == unseededStorage.symbolRowsByKind.mapValues(\.count))
+        #expect(Set(seededStorage.typeInfoByName.keys) == Set(unseededStorage.typeInfoByName.keys))
+        expectMembersClassifiedLikeFullSweep(seededStorage, unseededStorage, "seeded full sweep")
+    }
+
+    /// A scope no row matches falls back, but keeps what it collected: the
+    /// storage it hands back is collection-only (nothing swept, every
+    /// offset indexed) for the full build to adopt, and a seeded fallback
+    /// hands the seed back untouched.
+    @Test func unmatchedQueryScopeKeepsCollectedRows() throws {
+        let unmatchedQueryScope = QueryScope(contextManglingPrefixes: [Array("9NotAType".utf8)])
+
+        let unseededBuild = SymbolIndexStore.shared.buildPartialStorage(for: machOFile, adding: unmatchedQueryScope, seed: nil)
+        #expect(!unseededBuild.coversQueryScope)
+        let collectionOnlySweep = try #require(unseededBuild.storage.partialSweep)
+        #expect(collectionOnlySweep.contextManglingPrefixes.isEmpty)
+        #expect(!collectionOnlySweep.sweptRowMask.contains(true))
+
+        let queryScope = try #require(try scope(for: #require(types.first)))
+        let seed = SymbolIndexStore.shared.buildPartialStorage(for: machOFile, adding: queryScope, seed: nil).storage
+        let seededBuild = SymbolIndexStore.shared.buildPartialStorage(for: machOFile, adding: unmatchedQueryScope, seed: seed)
+        #expect(!seededBuild.coversQueryScope)
+        #expect(seededBuild.storage === seed)
+    }
+
+    /// Through `storage(in:)`, an unmatched scope resolves to the full
+    /// storage, built and cached as an unscoped lookup would.
+    @Test func unmatchedQueryScopeResolvesToFullStorage() throws {
+        SymbolIndexStore.shared.remove(for: machOFile)
+        let unmatchedQueryScope = QueryScope(contextManglingPrefixes: [Array("9NotAType".utf8)])
+
+        let storage = try #require(resolveStorage(scopedTo: unmatchedQueryScope))
+        #expect(storage.partialSweep == nil)
+        #expect(SymbolIndexStore.shared.contains(in: machOFile))
+        #expect(SymbolIndexStore.shared.storage(in: machOFile) === storage)
+    }
+
+    // MARK: - Concurrency with the full build and the demangler's thread hop
+
+    /// A scoped lookup made while an unscoped full build is running joins
+    /// that build instead of sweeping a partial storage it could not cache.
+    @Test func scopedLookupJoinsRunningFullBuild() async throws {
+        let queryScope = try #require(try scope(for: #require(types.first)))
+        SymbolIndexStore.shared.remove(for: machOFile)
+
+        let machOFile = machOFile
+        let fullBuild = Task.detached { SymbolIndexStore.shared.storage(in: machOFile) }
+        while !SymbolIndexStore.shared.containsOrIsBuilding(in: machOFile) {
+            await Task.yield()
+        }
+        let scopedStorage = resolveStorage(scopedTo: queryScope)
+        let fullStorage = await fullBuild.value
+
+        #expect(scopedStorage != nil)
+        #expect(scopedStorage === fullStorage)
+        #expect(scopedStorage?.partialSweep == nil)
+    }
+
+    /// Offset lookups made off the scoped task while the scope is active —
+    /// a detached task stands in for the demangler's large-stack worker,
+    /// which sees no task-locals either — resolve against the partial
+    /// storage instead of building the full one.
+    @Test func offsetLookupOffTheScopedTaskStaysPartial() async throws {
+        let queryScope = try #require(try scope(for: #require(types.first)))
+        SymbolIndexStore.shared.remove(for: machOFile)
+
+        let machOFile = machOFile
+        try await SymbolIndexStore.withQueryScope(queryScope, in: machOFile) {
+            let partialStorage = try #require(SymbolIndexStore.shared.storage(in: machOFile))
+            let offset = try #require(partialStorage.symbolRowsByOffset.keys.first)
+            let foundSymbols = await Task.detached { SymbolIndexStore.shared.symbols(for: offset, in: machOFile) != nil }.value
+            #expect(foundSymbols)
+            #expect(!SymbolIndexStore.shared.containsOrIsBuilding(in: machOFile))
+        }
+        #expect(!SymbolIndexStore.shared.contains(in: machOFile))
+        SymbolIndexStore.shared.remove(for: machOFile)
+    }
+}
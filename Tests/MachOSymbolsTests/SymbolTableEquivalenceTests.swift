@@ -16,10 +16,13 @@ import MachOFixtureSupport
 ///    on every entry of a real symbol table (the byte version re-states the
 ///    demangler's prefix list and would silently diverge if that list ever
 ///    grew);
-/// 2. the collection sweep retains exactly the rows the former
+/// 2. the bounded-buffer prefix-length scan the query-scoped sweep uses
+///    agrees with the demangler's `getManglingPrefixLength` on every entry
+///    (same re-stated list, plus the length it strips);
+/// 3. the collection sweep retains exactly the rows the former
 ///    `String`-keyed collection pass retained, with the same last-wins
 ///    canonical offsets;
-/// 3. binary search over the name-order permutation answers every row's own
+/// 4. binary search over the name-order permutation answers every row's own
 ///    materialized name with that row (the dictionary it replaced was
 ///    keyed on those exact strings).
 final class SymbolTableImageEquivalenceTests: MachOImageTests, @unchecked Sendable {
@@ -48,6 +51,32 @@ final class SymbolTableImageEquivalenceTests: MachOImageTests, @unchecked Sendab
         #expect(checkedCount > 0)
     }
 
+    @Test func byteLevelManglingPrefixLengthMatchesDemangler() throws {
+        var checkedCount = 0
+        var mismatchCount = 0
+        func check(nameC: UnsafePointer<CChar>, name: String) {
+            let nameBytes = UnsafeBufferPointer(start: UnsafeRawPointer(nameC).assumingMemoryBound(to: UInt8.self), count: strlen(nameC))
+            if (swiftManglingPrefixByteCount(nameBytes) ?? 0) != getManglingPrefixLength(name) {
+                mismatchCount += 1
+                if mismatchCount <= 3 {
+                    Issue.record("byte-level mangling prefix length mismatch for \(name)")
+                }
+            }
+            checkedCount += 1
+        }
+        if let symbols64 = machOImage.symbols64 {
+            for symbol in symbols64 {
+                check(nameC: symbol.nameC, name: symbol.name)
+            }
+        } else if let symbols32 = machOImage.symbols32 {
+            for symbol in symbols32 {
+                check(nameC: symbol.nameC, name: symbol.name)
+            }
+        }
+        #expect(mismatchCount == 0)
+        #expect(checkedCount > 0)
+    }
+
     @Test func mappedCollectionMatchesStringBasedCollection() throws {
         let storage = try #require(SymbolIndexStore.shared.storage(in: machOImage))
         let symbolTable = storage.symbolTable
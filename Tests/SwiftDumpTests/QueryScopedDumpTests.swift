@@ -0,0 +1,43 @@
+import Foundation
+import Testing
+import MachOKit
+import MachOFoundation
+@testable import MachOSwiftSection
+@testable import SwiftDump
+@_spi(Internals) import MachOSymbols
+@testable import MachOTestingSupport
+import MachOFixtureSupport
+
+/// `dumpInQueryScope` against the `SymbolTestsCore` fixture, along the path
+/// the MCP `dump_type` tool takes. The partial storages themselves are
+/// pinned in `MachOSymbolsTests` (`SymbolIndexStoreQueryScopeTests`); this
+/// suite pins what the request promises on top of them: the scoped dump of
+/// any one type neither builds the full symbol index nor changes a byte of
+/// output.
+///
+/// Serialized: every test evicts and rebuilds the shared per-file storage.
+@Suite(.serialized)
+final class QueryScopedDumpTests: MachOFileTests, @unchecked Sendable {
+    override class var fileName: MachOFileName { .SymbolTestsCore }
+
+    /// `dumpInQueryScope` output is byte-identical to `dump` for every type,
+    /// and each scoped dump — starting from an empty cache — completes
+    /// without the full storage ever being built, including through the
+    /// demangler's large-stack thread hop.
+    @Test func scopedDumpMatchesUnscopedDumpWithoutFullBuild() async throws {
+        let types = try machOFile.swift.types
+        let typeNames = types.map { (try? $0.typeContextDescriptorWrapper.namedContextDescriptor.name(in: machOFile)) ?? "<unnamed>" }
+        var scopedDumps: [String] = []
+        for (type, typeName) in zip(types, typeNames) {
+            SymbolIndexStore.shared.remove(for: machOFile)
+            try await scopedDumps.append(type.dumpInQueryScope(using: .test, in: machOFile).string)
+            #expect(!SymbolIndexStore.shared.contains(in: machOFile), "\(typeName): scoped dump built the full storage")
+        }
+
+        SymbolIndexStore.shared.remove(for: machOFile)
+        for (type, (typeName, scopedDump)) in zip(types, zip(typeNames, scopedDumps)) {
+            let dump = try await type.dumpable.dump(using: .test, in: machOFile).string
+            #expect(scopedDump == dump, "\(typeName)")
+        }
+    }
+}